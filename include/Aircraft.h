@@ -3,6 +3,7 @@
 #include "AircraftConfig.h"
 #include "ChargerPool.h"
 #include "AircraftStats.h"
+#include <cstdint>
 #include <memory>
 #include <random>
 
@@ -18,6 +19,11 @@ class Aircraft {
 public:
     Aircraft(CompanyType type, std::shared_ptr<ChargerPool> charger_pool);
 
+    // Bulk-construction path: explicit RNG seed and an unchecked config lookup,
+    // so no bounds check or std::random_device syscall is paid per vehicle.
+    // 'type' must be a valid CompanyType (i.e. not Count).
+    Aircraft(CompanyType type, std::shared_ptr<ChargerPool> charger_pool, uint32_t seed);
+
     // Core simulation step. 
     // Handles state transitions even if they occur in the middle of dt_hours.
     void update(double dt_hours);
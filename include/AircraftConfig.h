@@ -28,8 +28,9 @@ struct AircraftConfig {
     int passenger_count;
     double fault_prob_per_hour;
 
-    // Static Lookup for aircraft configuration
-    static const AircraftConfig& GetConfig(CompanyType type) {
+    // Static table of all manufacturer configurations, indexed by CompanyType.
+    // Unchecked: callers that already hold a valid CompanyType may index it directly.
+    static const std::array<AircraftConfig, static_cast<int>(CompanyType::Count)>& Table() {
         static const std::array<AircraftConfig, static_cast<int>(CompanyType::Count)> configs = {{
             // Name,    Speed, Cap,  ChgTime, Usage, Pax, FaultRate
             {"Alpha",   120,   320,  0.60,    1.6,   4,   0.25},
@@ -38,7 +39,12 @@ struct AircraftConfig {
             {"Delta",    90,   120,  0.62,    0.8,   2,   0.22},
             {"Echo",     30,   150,  0.30,    5.8,   2,   0.61}
         }};
+        return configs;
+    }
 
+    // Static Lookup for aircraft configuration
+    static const AircraftConfig& GetConfig(CompanyType type) {
+        const auto& configs = Table();
         int index = static_cast<int>(type);
         if (index < 0 || index >= configs.size()) {
             throw std::runtime_error("Invalid CompanyType index");
@@ -0,0 +1,30 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "AircraftConfig.h"
+
+/**
+ * Compact description of a fleet: how many vehicles of each manufacturer
+ * to build, plus a master seed from which every per-vehicle RNG stream is
+ * derived. Lets large scenarios be constructed in bulk and reproduced exactly.
+ */
+struct FleetMix {
+    std::array<int, static_cast<int>(CompanyType::Count)> counts{};
+    uint64_t seed = 0;
+
+    // Summed in 64 bits so oversized mixes can be detected rather than overflow.
+    int64_t total() const {
+        int64_t sum = 0;
+        for (int c : counts) sum += c;
+        return sum;
+    }
+
+    // SplitMix64 finalizer: maps (seed, vehicle index) to an independent
+    // 32-bit RNG seed without touching std::random_device.
+    static uint32_t DeriveSeed(uint64_t seed, uint64_t index) {
+        uint64_t z = seed + (index + 1) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return static_cast<uint32_t>(z ^ (z >> 31));
+    }
+};
@@ -5,6 +5,7 @@
 #include <atomic>
 #include "Aircraft.h"
 #include "ChargerPool.h"
+#include "FleetMix.h"
 
 /**
  * Orchestrates the eVTOL simulation lifecycle, thread management, 
@@ -18,9 +19,17 @@ public:
     // Mode parameter with FIXED as default
     Simulator(int num_aircraft, int num_chargers, double duration_minutes, TimingMode mode = TimingMode::FIXED);
 
+    // Bulk path: builds the exact type counts in 'mix' in parallel,
+    // seeding every vehicle deterministically from mix.seed.
+    Simulator(const FleetMix& mix, int num_chargers, double duration_minutes, TimingMode mode = TimingMode::FIXED);
+
     // Starts the simulation and blocks until the duration is reached
     void run();
 
+    // --- Fleet & Startup Metrics ---
+    const std::vector<std::shared_ptr<Aircraft>>& get_fleet() const { return fleet_; }
+    double get_fleet_build_seconds() const { return fleet_build_seconds_; }
+
 private:
     // Core logic executed by each aircraft thread
     static void worker_thread(std::shared_ptr<Aircraft> aircraft, 
@@ -30,6 +39,10 @@ private:
                               TimingMode mode);
 
     
+    // Constructs fleet_ from one type per vehicle, spreading the work across cores.
+    // Vehicle i is seeded with FleetMix::DeriveSeed(seed, i).
+    void build_fleet(const std::vector<CompanyType>& types, uint64_t seed);
+
     // Data aggregation and reporting logic
     void generate_report() const;
 
@@ -40,4 +53,8 @@ private:
     // Shared resources and vehicle fleet
     std::shared_ptr<ChargerPool> charger_pool_;
     std::vector<std::shared_ptr<Aircraft>> fleet_;
+
+    // Startup phase timings (wall-clock seconds) surfaced in the report
+    double fleet_build_seconds_ = 0.0;
+    double thread_deploy_seconds_ = 0.0;
 };
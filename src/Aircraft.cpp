@@ -1,21 +1,33 @@
 #include "Aircraft.h"
 #include <algorithm>
 #include <random>
+#include <utility>
 
+namespace {
+// Runs GetConfig's bounds check so an invalid type throws before any table lookup.
+CompanyType validated(CompanyType type) {
+    AircraftConfig::GetConfig(type);
+    return type;
+}
+} // namespace
+
+// Legacy path: validates 'type', then seeds the Mersenne Twister engine
+// from a local random_device, costing one syscall per aircraft instance.
 Aircraft::Aircraft(CompanyType type, std::shared_ptr<ChargerPool> charger_pool)
+    : Aircraft(validated(type), std::move(charger_pool), std::random_device{}())
+{
+}
+
+Aircraft::Aircraft(CompanyType type, std::shared_ptr<ChargerPool> charger_pool, uint32_t seed)
     : type_(type),
-      config_(AircraftConfig::GetConfig(type)),
+      config_(AircraftConfig::Table()[static_cast<int>(type)]),
+      charger_pool_(std::move(charger_pool)),
       current_battery_kwh_(config_.battery_capacity_kwh),
-      charger_pool_(charger_pool),
+      rng_(seed),
       dist_0_1_(0.0, 1.0) 
 {
-    // Thread-safe RNG initialization. 
-    // Using a local random_device to seed the Mersenne Twister engine per aircraft instance.
-    std::random_device rd;
-    rng_.seed(rd());
 }
 
-
 // Core simulation loop for a single aircraft.
 void Aircraft::update(double dt_hours) {
     double remaining_time = dt_hours;
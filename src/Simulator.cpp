@@ -6,28 +6,123 @@
 #include <mutex>
 #include <map>
 #include <algorithm>
+#include <climits>
+#include <exception>
+#include <random>
+#include <stdexcept>
 
 // Mapping: 1s real-world = 1m simulation. 10ms tick ensures high resolution.
 static constexpr int TICK_MS = 10; 
 static constexpr double SIM_SPEEDUP = 60.0;
 static constexpr double SIM_DT_HOURS = (TICK_MS / 1000.0) * SIM_SPEEDUP / 3600.0;
 
+// Fleets smaller than this are built on the calling thread; parallel build
+// only pays off once each worker has a meaningful slice of vehicles.
+static constexpr size_t MIN_BUILD_CHUNK = 4096;
+
 // Mutex to prevent console log interleaving from multiple aircraft threads.
 static std::mutex print_mutex;
 
 Simulator::Simulator(int num_aircraft, int num_chargers, double duration_minutes, TimingMode mode)
     : num_aircraft_(num_aircraft), duration_minutes_(duration_minutes), mode_(mode) // Initialize mode
 {
+    auto build_start = std::chrono::steady_clock::now();
     charger_pool_ = std::make_shared<ChargerPool>(num_chargers);
     
     // Fixed seed for deterministic vehicle distribution across different runs.
     std::mt19937 factory_rng(12345);
     std::uniform_int_distribution<int> type_dist(0, 4);
 
-    fleet_.reserve(num_aircraft_);
-    for (int i = 0; i < num_aircraft_; ++i) {
-        CompanyType type = static_cast<CompanyType>(type_dist(factory_rng));
-        fleet_.push_back(std::make_shared<Aircraft>(type, charger_pool_));
+    std::vector<CompanyType> types(num_aircraft_);
+    for (auto& type : types) {
+        type = static_cast<CompanyType>(type_dist(factory_rng));
+    }
+
+    // Fault streams stay non-deterministic between runs, but a single
+    // random_device draw now seeds the whole fleet instead of one per vehicle.
+    std::random_device rd;
+    build_fleet(types, rd());
+
+    fleet_build_seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - build_start).count();
+}
+
+Simulator::Simulator(const FleetMix& mix, int num_chargers, double duration_minutes, TimingMode mode)
+    : num_aircraft_(0), duration_minutes_(duration_minutes), mode_(mode)
+{
+    auto build_start = std::chrono::steady_clock::now();
+    for (int count : mix.counts) {
+        if (count < 0) {
+            throw std::runtime_error("FleetMix counts must be non-negative");
+        }
+    }
+    if (mix.total() > INT_MAX) {
+        throw std::runtime_error("FleetMix total exceeds supported fleet size");
+    }
+    num_aircraft_ = static_cast<int>(mix.total());
+    charger_pool_ = std::make_shared<ChargerPool>(num_chargers);
+
+    // Contiguous blocks per manufacturer: Alpha vehicles first, then Beta, etc.
+    std::vector<CompanyType> types;
+    types.reserve(num_aircraft_);
+    for (int t = 0; t < static_cast<int>(CompanyType::Count); ++t) {
+        types.insert(types.end(), mix.counts[t], static_cast<CompanyType>(t));
+    }
+
+    build_fleet(types, mix.seed);
+
+    fleet_build_seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - build_start).count();
+}
+
+void Simulator::build_fleet(const std::vector<CompanyType>& types, uint64_t seed) {
+    // Every entry in 'types' comes from a validated range, so the seeded
+    // Aircraft constructor can skip the per-vehicle bounds check.
+    const size_t n = types.size();
+    fleet_.assign(n, nullptr);
+
+    // Each worker owns a disjoint slice of fleet_, so no synchronization is needed.
+    auto build_range = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            fleet_[i] = std::make_shared<Aircraft>(types[i], charger_pool_, FleetMix::DeriveSeed(seed, i));
+        }
+    };
+
+    size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    workers = std::min(workers, (n + MIN_BUILD_CHUNK - 1) / MIN_BUILD_CHUNK);
+    if (workers <= 1) {
+        build_range(0, n);
+        return;
+    }
+
+    // Exceptions (e.g. std::bad_alloc on huge fleets) must not escape a worker,
+    // or std::terminate fires. Each worker parks its failure in its own slot and
+    // the first one is rethrown here once every started thread has been joined.
+    const size_t chunk = (n + workers - 1) / workers;
+    std::vector<std::exception_ptr> errors(workers);
+    std::vector<std::thread> builders;
+    builders.reserve(workers);
+
+    auto join_all = [&builders]() {
+        for (auto& t : builders) { if (t.joinable()) t.join(); }
+    };
+
+    try {
+        for (size_t w = 0, begin = 0; begin < n; ++w, begin += chunk) {
+            builders.emplace_back([&, w, begin]() {
+                try {
+                    build_range(begin, std::min(begin + chunk, n));
+                } catch (...) {
+                    errors[w] = std::current_exception();
+                }
+            });
+        }
+    } catch (...) {
+        join_all();
+        throw;
+    }
+    join_all();
+
+    for (const auto& e : errors) {
+        if (e) std::rethrow_exception(e);
     }
 }
 
@@ -38,9 +133,12 @@ void Simulator::run() {
     std::atomic<bool> running{true};
 
     // Spin up one thread per aircraft to simulate concurrent behavior.
+    auto deploy_start = std::chrono::steady_clock::now();
+    threads.reserve(fleet_.size());
     for (auto& aircraft : fleet_) {
         threads.emplace_back(worker_thread, aircraft, std::ref(running), SIM_DT_HOURS, TICK_MS, mode_);
     }
+    thread_deploy_seconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - deploy_start).count();
 
     auto start_time = std::chrono::steady_clock::now();
     while (true) {
@@ -80,6 +178,15 @@ void Simulator::generate_report() const {
 
     std::map<CompanyType, GroupStats> report_map;
 
+    // --- Part 0: Startup Phase ---
+    // Cold-start cost, tracked separately from the simulated horizon
+    std::cout << "\n--- Startup Phase ---" << std::endl;
+    std::cout << std::fixed << std::setprecision(3)
+              << std::left << std::setw(20) << "Fleet Build(ms)"   << (fleet_build_seconds_ * 1000.0) << "\n"
+              << std::left << std::setw(20) << "Thread Deploy(ms)" << (thread_deploy_seconds_ * 1000.0) << "\n"
+              << std::left << std::setw(20) << "Total Startup(ms)"
+              << ((fleet_build_seconds_ + thread_deploy_seconds_) * 1000.0) << std::endl;
+
     // --- Part 1: Individual Vehicle Final States ---
     // Useful for identifying outliers and verifying state-machine transitions
     const int ind_w = 11;